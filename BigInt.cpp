@@ -1,44 +1,68 @@
 #include "BigInt.h"
 
+static std::string digitsToString(const std::vector<int>& digits)
+// absolute value as string; requires reverse iterator of digits
+{
+	std::string num;
+	for (auto it = digits.crbegin(); it != digits.crend(); ++it)
+		num += ('0' + *it);
+	return num;
+}
+static std::size_t hashDigits(const std::vector<int>& digits)
+// combines the hashes of all the digits, the same way as boost::hash_combine
+{
+	std::size_t seed = 0;
+	for (auto it = digits.cbegin(); it != digits.cend(); ++it)
+		seed ^= std::hash<int>{}(*it) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	return seed;
+}
+static int sumDigits(const std::vector<int>& digits)
+{
+	int sum = 0;
+	for (auto it = digits.cbegin(); it != digits.cend(); ++it) {
+		sum += *it;
+	}
+	return sum;
+}
+
 //CONSTRUCTORS
 BigInt::BigInt()
-	:digits(1, 0), sign(Sign::positive) // initialize to one digit: zero
+	:ownDigits(1, 0), sign(Sign::positive) // initialize to one digit: zero
 {
 
 }
 BigInt::BigInt(int a)
 	: sign(Sign::positive)
 {
+	std::vector<int>& digs = mutableDigits();
 	if (a < 0) {
 		sign = Sign::negative;
 		a *= (-1);
 	}
 	if (a == 0) // Handle 0 specifically since it won't be caught by the following loop
-		digits.push_back(0);
+		digs.push_back(0);
 	for ( ; a != 0; ) {
 		int lastDigit = a % 10; // get the least sig. digit
-		digits.push_back(lastDigit);
+		digs.push_back(lastDigit);
 		a /= 10; // get to next digit
 	}
 }
 BigInt::BigInt(std::string s)
 	: sign(Sign::positive)
 {
-	if (s == "") {
-		BigInt::BigInt();
-		return;
-	}
-
-	if (s[0] == '-') { // handle the leading '-' sign
+	std::vector<int>& digs = mutableDigits();
+	if (s != "" && s[0] == '-') { // handle the leading '-' sign
 		sign = Sign::negative;
 		s.erase(0, 1); // leave only numbers in the string
 	}
 	// need to read number is reverse order since that's how they are stored
 	for (auto it = s.crbegin(); it != s.crend(); ++it) {
 		if (isdigit(*it))
-			digits.push_back((*it) - '0');
+			digs.push_back((*it) - '0');
 	}
-
+	if (digs.empty()) // eg. "" or "-"; initialize to zero
+		digs.push_back(0);
+	normalize(); // "007" is 7 and "-0" is 0; other functions rely on no leading zeros
 }
 
 //INTERFACE FUNCTIONS
@@ -49,8 +73,8 @@ int BigInt::toInt() const
 
 	int result = 0;
 	int currPowerOfTen = 1; // instead of using pow() function from <cmath>
-	for (int i = 0; i < digits.size(); ++i) {
-		result += digits[i] * currPowerOfTen;
+	for (int i = 0; i < size(); ++i) {
+		result += digits()[i] * currPowerOfTen;
 		currPowerOfTen *= 10; // get to the next power of ten
 	}
 
@@ -61,57 +85,115 @@ int BigInt::toInt() const
 }
 std::string BigInt::toString() const
 {
-	// requires reverse iterator of digits;
 	std::string num;
 	if (sign == Sign::negative)
 		num += "-";
-	for (auto it = digits.crbegin(); it != digits.crend(); ++it)
-		num += ('0' + *it);
+	if (isShared()) // shared digits can't change, so they need to be converted only once
+		num += sharedDigits->str();
+	else
+		num += digitsToString(digits());
 	return num;
 }
 int BigInt::digitSum() const
 {
-	int sum = 0;
-	for (auto it = digits.cbegin(); it != digits.cend(); ++it) {
-		sum += *it;
-	}
-	return sum;
+	if (isShared())
+		return sharedDigits->digitSum();
+	return sumDigits(digits());
+}
+std::size_t BigInt::hash() const
+// hash of the digits, with all bits flipped for negative numbers; (a == b) means (a.hash() == b.hash())
+{
+	std::size_t result;
+	if (isShared())
+		result = sharedDigits->hash();
+	else
+		result = hashDigits(digits());
+
+	if (sign == Sign::negative)
+		result = ~result;
+	return result;
 }
-BigInt BigInt::abs() const // seems very inefficient, perhaps needs some work
+BigInt BigInt::abs() const // O(1) for shared numbers, since the copy only points to the same digits
 {
 	BigInt copy = (*this);
 	copy.sign = Sign::positive;
 	return copy;
 }
+void BigInt::negate()
+// only the sign changes, digits are left alone
+{
+	if (isZero()) // zero has to stay "positive" or else comparisons may fail
+		return;
+	if (sign == Sign::positive)
+		sign = Sign::negative;
+	else
+		sign = Sign::positive;
+}
+
+//SHARED STORAGE
+void BigInt::share()
+{
+	if (isShared())
+		return;
+	sharedDigits = std::make_shared<SharedDigits>(std::move(ownDigits));
+	ownDigits.clear();
+}
 
 //HELPER FUNCTIONS
+std::vector<int>& BigInt::mutableDigits()
+// Every function which changes the digits has to get them from here
+{
+	if (isShared()) { // shared digits are never changed, since they may be read from other threads; make a copy
+		ownDigits = sharedDigits->digits;
+		sharedDigits.reset();
+	}
+	return ownDigits;
+}
+const std::string& BigInt::SharedDigits::str()
+{
+	std::call_once(strOnce, [this] { strValue = digitsToString(digits); });
+	return strValue;
+}
+int BigInt::SharedDigits::digitSum()
+{
+	std::call_once(digitSumOnce, [this] { digitSumValue = sumDigits(digits); });
+	return digitSumValue;
+}
+std::size_t BigInt::SharedDigits::hash()
+{
+	std::call_once(hashOnce, [this] { hashValue = hashDigits(digits); });
+	return hashValue;
+}
 void BigInt::normalize()
 // remove all the leading zeroes, if the whole number == 0, then leave one last
 {
-	for (int i = digits.size() - 1; i > 0; --i) {
-		if (digits[i] != 0)
+	std::vector<int>& digs = mutableDigits();
+	for (int i = digs.size() - 1; i > 0; --i) {
+		if (digs[i] != 0)
 			return;
 		else
-			digits.pop_back();
+			digs.pop_back();
 	}
-	if (digits.size() == 1 && digits[0] == 0) // make sure that zero is "positive" or else comparisons may fail
+	if (digs.size() == 1 && digs[0] == 0) // make sure that zero is "positive" or else comparisons may fail
 		sign = Sign::positive;
 }
 void BigInt::addSigDigits(int value)
 //add the number as the most significant digits, eg. num is 234, addSigDigits(87) == 87234
 //if zero is passed, than add one zero
 {
+	std::vector<int>& digs = mutableDigits();
 	if (value == 0)
-		digits.push_back(0);
+		digs.push_back(0);
 	for (; value != 0;) {
-		digits.push_back(value % 10);
+		digs.push_back(value % 10);
 		value /= 10;
 	}
 }
 void BigInt::borrow(int toThisDig)
 // Assumes, that borrowing is possible -- it is caller's responsibility to make sure it is
 {
-	auto thisDig = digits.begin() + toThisDig; // thisDig serves as a 'bookmark' to come back to after borrowing
+	std::vector<int>& digs = mutableDigits();
+	auto thisDig = digs.begin() + toThisDig; // thisDig serves as a 'bookmark' to come back to after borrowing
 	auto it = thisDig + 1; // it is the actual "borrowing" iterator
 	for (; (*it) != 0; ++it) {
 		// NOTHING - loop gets 'it' to first non-zero digit after thisDig
@@ -121,6 +203,38 @@ void BigInt::borrow(int toThisDig)
 		(*it) += 9;
 	(*it) += 10; // finally got to the borrowed digit; increase it by 10 (because there will be no further borrowing)
 }
+void BigInt::incrementAbs()
+// add 1 to the absolute value; carry goes only through the trailing nines, eg. 1299 -> 1300
+{
+	std::vector<int>& digs = mutableDigits();
+	for (auto it = digs.begin(); it != digs.end(); ++it) {
+		if ((*it) != 9) {
+			(*it) += 1;
+			return;
+		}
+		(*it) = 0; // 9 + 1 == 10: leave 0 and carry over 1 to the next digit
+	}
+	addSigDigits(1); // all digits were nines, eg. 999 -> 1000
+}
+void BigInt::decrementAbs()
+// subtract 1 from the absolute value; borrow goes only through the trailing zeros, eg. 1300 -> 1299
+// Assumes, that the absolute value is nonzero -- it is caller's responsibility to make sure it is
+{
+	std::vector<int>& digs = mutableDigits();
+	auto it = digs.begin();
+	for (; it != digs.end() && (*it) == 0; ++it) {
+		// NOTHING - loop gets 'it' to the first non-zero digit
+	}
+	if (it == digs.end()) // absolute value is zero, nothing to borrow from
+		return;
+	(*it) -= 1;
+	for (auto zero = digs.begin(); zero != it; ++zero)
+		(*zero) = 9; // 0 - 1 == -1: leave 9 and borrow 1 from the next digit
+	if ((*it) == 0 && it + 1 == digs.end() && digs.size() > 1) // most significant digit became zero, eg. 1000 -> 0999
+		digs.pop_back();
+	if (isZero()) // make sure that zero is "positive"
+		sign = Sign::positive;
+}
 
 //ARITHMETIC OPERATORS
 BigInt& BigInt::operator+=(const BigInt& rhs) // Implements the basic "long addition"
@@ -129,12 +243,13 @@ BigInt& BigInt::operator+=(const BigInt& rhs) // Implements the basic "long addi
 		*this -= ((-1) * rhs);
 		return *this;
 	}
+	std::vector<int>& digs = mutableDigits();
 	if (rhs.size() > this->size()) //if a is bigger than expand the space to fit all the digits
-		digits.resize(rhs.size());
+		digs.resize(rhs.size());
 	int carryOver = 0;
 	for (int i = 0; i < rhs.size(); ++i) {
-		int sum = carryOver + digits[i] + rhs.digits[i];
-		digits[i] = sum % 10; // set to the last digit of sum: eg 5 + 7 = 12, so you set digit[i] to 2
+		int sum = carryOver + digs[i] + rhs.digits()[i];
+		digs[i] = sum % 10; // set to the last digit of sum: eg 5 + 7 = 12, so you set digit[i] to 2
 		carryOver = sum / 10; // carry over the rest of the sum: in case of 12 it is 12/10 == 1 (truncated)
 	}
 	// Take care of the leftover carryOver
@@ -142,8 +257,8 @@ BigInt& BigInt::operator+=(const BigInt& rhs) // Implements the basic "long addi
 	if (carryOver != 0) {
 		if (rhs.size() < this->size()) { // *this has got place to fit some carry over from rhs -- no need to expand the vector of digits
 			for (int i = rhs.size(); (i < this->size()) && (carryOver != 0); ++i) {
-				int sum = digits[i] + carryOver;
-				digits[i] = sum % 10;
+				int sum = digs[i] + carryOver;
+				digs[i] = sum % 10;
 				carryOver = sum / 10;
 			}
 		}
@@ -179,10 +294,11 @@ BigInt& BigInt::operator-=(const BigInt& rhs) // Implements the basic "long subr
 		return *this;
 	}
 
+	std::vector<int>& digs = mutableDigits();
 	for (int i = 0; i < rhs.size(); ++i) { // subtract corresponding digits; if second one is bigger, then borrow
-		if (digits[i] < rhs.digits[i])
+		if (digs[i] < rhs.digits()[i])
 			borrow(i);
-		digits[i] -= rhs.digits[i];
+		digs[i] -= rhs.digits()[i];
 	}
 	
 	normalize(); // delete leading zeros
@@ -214,9 +330,9 @@ BigInt&  BigInt::operator*=(const BigInt& rhs) // Implements the basic "long mul
 		}
 		int carryOver = 0;
 		for (int j = 0; j < this->size(); ++j) {
-			int result = (rhs.digits[i] * digits[j]) + carryOver;
+			int result = (rhs.digits()[i] * digits()[j]) + carryOver;
 			if ((i == 0) && (j == 0)) // BigInt() initializes digits to vector<int>(1, 0)
-				midSum.digits[0] = result % 10;
+				midSum.mutableDigits()[0] = result % 10;
 			else
 				midSum.addSigDigits((result % 10)); // last digit, in the proper power
 			carryOver = result / 10;
@@ -228,7 +344,8 @@ BigInt&  BigInt::operator*=(const BigInt& rhs) // Implements the basic "long mul
 		result += midSum;
 	}
 	result.normalize();
-	digits = result.digits; // not assigning fully (*this = result) so as to preserve sign information
+	sharedDigits.reset(); // old digits are not needed, so no point in copying them like mutableDigits() would
+	ownDigits = result.digits(); // not assigning fully (*this = result) so as to preserve sign information
 	return *this;
 
 }
@@ -240,6 +357,59 @@ BigInt operator*(const BigInt& lhs, const BigInt& rhs)
 	return result;
 }
 
+BigInt BigInt::operator+() const
+{
+	return (*this);
+}
+BigInt BigInt::operator-() const &
+// (*this) has to stay untouched, so the digits need to be copied
+{
+	BigInt copy{ *this };
+	copy.negate();
+	return copy;
+}
+BigInt BigInt::operator-() &&
+// (*this) is a temporary: give away its digits, and flip the sign of the result
+{
+	BigInt result{ std::move(*this) };
+	result.negate();
+	return result;
+}
+
+//INCREMENT & DECREMENT OPERATORS
+BigInt& BigInt::operator++()
+{
+	if (sign == Sign::negative) // (-a) + 1 == -(a - 1)
+		decrementAbs();
+	else
+		incrementAbs();
+	return *this;
+}
+BigInt BigInt::operator++(int)
+{
+	BigInt old{ *this };
+	++(*this);
+	return old;
+}
+BigInt& BigInt::operator--()
+{
+	if (isZero()) { // 0 - 1 == -1; the only case where the sign changes
+		mutableDigits()[0] = 1;
+		sign = Sign::negative;
+	}
+	else if (sign == Sign::negative) // (-a) - 1 == -(a + 1)
+		incrementAbs();
+	else
+		decrementAbs();
+	return *this;
+}
+BigInt BigInt::operator--(int)
+{
+	BigInt old{ *this };
+	--(*this);
+	return old;
+}
+
 //OTHER MATHEMATICAL FUNCTIONS
 void BigInt::pow(int n)
 {
@@ -250,12 +420,14 @@ void BigInt::pow(int n)
 //COMPARISON OPERATORS
 bool operator==(const BigInt& lhs, const BigInt& rhs)
 {
+	if (lhs.sharesDigitsWith(rhs)) // same digits; only the sign can differ
+		return (lhs.sign == rhs.sign);
 	// different signs == different numbers
 	if ((lhs.size() != rhs.size()) || (lhs.sign != rhs.sign))
 		return false;
 	else
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
+			if (lhs.digits()[i] != rhs.digits()[i])
 				return false;
 		}
 	return true; // sign and all digits are the same - numbers are equal
@@ -275,8 +447,8 @@ bool operator<(const BigInt& lhs, const BigInt& rhs)
 		if (lhs.size() != rhs.size())
 			return (lhs.size() < rhs.size());
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (lhs.digits[i] < rhs.digits[i]);
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (lhs.digits()[i] < rhs.digits()[i]);
 		}
 	}
 
@@ -285,8 +457,8 @@ bool operator<(const BigInt& lhs, const BigInt& rhs)
 		if (lhs.size() != rhs.size())
 			return (!(lhs.size() < rhs.size()));
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (!(lhs.digits[i] < rhs.digits[i]));
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (!(lhs.digits()[i] < rhs.digits()[i]));
 		}
 	}
 	return false; // numbers are equal; return false
@@ -301,8 +473,8 @@ bool operator>(const BigInt& lhs, const BigInt& rhs)
 		if (lhs.size() != rhs.size())
 			return (lhs.size() > rhs.size());
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (lhs.digits[i] > rhs.digits[i]);
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (lhs.digits()[i] > rhs.digits()[i]);
 		}
 	}
 
@@ -310,8 +482,8 @@ bool operator>(const BigInt& lhs, const BigInt& rhs)
 		if (lhs.size() != rhs.size())
 			return (!(lhs.size() > rhs.size()));
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (!(lhs.digits[i] > rhs.digits[i]));
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (!(lhs.digits()[i] > rhs.digits()[i]));
 		}
 	}
 
@@ -328,16 +500,16 @@ bool operator<=(const BigInt& lhs, const BigInt& rhs)
 		if (lhs.size() != rhs.size())
 			return (lhs.size() < rhs.size());
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (lhs.digits[i] < rhs.digits[i]);
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (lhs.digits()[i] < rhs.digits()[i]);
 		}
 	}
 	if (lhs.sign == BigInt::Sign::negative) {
 		if (lhs.size() != rhs.size())
 			return (!(lhs.size() < rhs.size()));
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (!(lhs.digits[i] < rhs.digits[i]));
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (!(lhs.digits()[i] < rhs.digits()[i]));
 		}
 	}
 	return true; // numbers are equal; return true*/
@@ -353,16 +525,16 @@ bool operator>=(const BigInt& lhs, const BigInt& rhs)
 		if (lhs.size() != rhs.size())
 			return (lhs.size() > rhs.size());
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (lhs.digits[i] > rhs.digits[i]);
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (lhs.digits()[i] > rhs.digits()[i]);
 		}
 	}
 	if (lhs.sign == BigInt::Sign::negative) {
 		if (lhs.size() != rhs.size())
 			return (!(lhs.size() > rhs.size()));
 		for (int i = lhs.size() - 1; i >= 0; --i) {
-			if (lhs.digits[i] != rhs.digits[i])
-				return (!(lhs.digits[i] > rhs.digits[i]));
+			if (lhs.digits()[i] != rhs.digits()[i])
+				return (!(lhs.digits()[i] > rhs.digits()[i]));
 		}
 	}
 	return true; // numbers are equal; return true*/
@@ -5,6 +5,15 @@
 * significant digit of the number. It also happens that it is
 * the exponent to which the base is raised:
 * if digit[3] == n, then the value of n == n * 10^3
+*
+* By default every BigInt has its own vector of digits.
+* After share() is called, the digits are moved to a SharedDigits object
+* held by shared_ptr, and copies (and abs()) only point to the same one.
+* Shared digits are never changed: any modification gives the number
+* its own copy of the digits first ("copy-on-write"), and the number is
+* no longer shared until share() is called again. So shared numbers can
+* be read from many threads at once. SharedDigits also remembers
+* toString(), digitSum() and hash() results, since its digits can't change.
 */
 
 /*
@@ -12,7 +21,7 @@
 *   [ ] arithmetic operators
 *   [x] normalize function
 *   [x] comparing operators
-*   [ ] increment(decrement) operators
+*   [x] increment(decrement) operators
 *   [ ] constructors:
 *		[ ] all integer types
 *		[x] string
@@ -25,9 +34,14 @@
 *	[ ] factorisation
 */
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 class BigInt
@@ -41,9 +55,16 @@ public:
 	//INTERFACE FUNCTIONS
 	int toInt() const; // returns int form of the number, if it can fit; else throws exception
 	std::string toString() const; // returns string form of the number
-	int size() const { return digits.size(); } // returns number of digits
+	int size() const { return digits().size(); } // returns number of digits
 	int digitSum() const; // returns the sum of the digits within the number, USES INT, NOT BIGINT
-	BigInt abs() const; // return absolute value of the number, seems kinda inefficient
+	std::size_t hash() const; // hash value consistent with operator==, used by std::hash<BigInt>
+	BigInt abs() const; // return absolute value of the number; O(1) if shared, else copies the digits
+	void negate(); // reverse the sign in place; zero stays positive
+
+	//SHARED STORAGE
+	void share(); // from now on copies of this number share its digits (copy-on-write)
+	bool isShared() const { return sharedDigits != nullptr; }
+	bool sharesDigitsWith(const BigInt& other) const { return isShared() && sharedDigits == other.sharedDigits; }
 
 	//OUTPUT & INPUT OPERATORS
 	friend std::ostream& operator<<(std::ostream& os, const BigInt& bi); // this one currently does not need friend status
@@ -65,8 +86,18 @@ public:
 	BigInt& operator%=(const BigInt& lhs); // NOT IMPLEMENTED
 	friend BigInt operator%(const BigInt& lhs, const BigInt& rhs);
 
-	BigInt operator+(); // NOT IMPLEMENTED; Unary plus: does nothing
-	BigInt operator-(); // NOT IMPLEMENTED; Unary minus: reverse the sign
+	BigInt operator+() const; // Unary plus: does nothing
+	BigInt operator-() const &; // Unary minus: copy, and reverse the sign of the copy
+	BigInt operator-() &&; // Unary minus on a temporary: takes its digits, no copying of digits
+
+	//INCREMENT & DECREMENT OPERATORS
+	// only the digits reached by the carry (borrow) are touched, eg. 1299 -> 1300 touches three digits;
+	// that is amortized O(1) over a run of only increments (or only decrements), but alternating
+	// ++ and -- across a power of ten (999 <-> 1000) touches all the digits every time
+	BigInt& operator++(); // prefix
+	BigInt operator++(int); // postfix
+	BigInt& operator--(); // prefix
+	BigInt operator--(int); // postfix
 
 	//OTHER MATHEMATICAL FUNCTIONS
 	void pow(int n); // NOT IMPLEMENTED; raise (*this) to the power n
@@ -85,9 +116,36 @@ private:
 	void normalize(); // remove all leading zeros, if all of digits == 0, then leave digits[0]
 	void addSigDigits(int value); // add the number as the most significant digits (value > 0), eg. num is 234, addSigDigits(87) == 87234
 	void borrow(int toThisDig); // borrow to this digit (used for subtraction)
+	void incrementAbs(); // add 1 to the absolute value, ignoring the sign
+	void decrementAbs(); // subtract 1 from the absolute value, ignoring the sign; absolute value has to be nonzero
+	bool isZero() const { return digits().size() == 1 && digits()[0] == 0; }
 
 	//THE NUMBER, AND SIGN STORED
-	std::vector<int> digits;
+	struct SharedDigits
+	{
+		explicit SharedDigits(std::vector<int> d) : digits(std::move(d)) {}
+
+		const std::vector<int> digits;
+
+		// values computed from the digits; each one is computed once, on first use, even if
+		// many threads ask at the same time; afterwards reading it needs no locking
+		const std::string& str(); // absolute value as string
+		int digitSum();
+		std::size_t hash(); // hash of the absolute value
+
+	private:
+		std::once_flag strOnce;
+		std::string strValue;
+		std::once_flag digitSumOnce;
+		int digitSumValue = 0;
+		std::once_flag hashOnce;
+		std::size_t hashValue = 0;
+	};
+	const std::vector<int>& digits() const { return isShared() ? sharedDigits->digits : ownDigits; }
+	std::vector<int>& mutableDigits(); // own digits; if shared, copies them first and stops sharing
+
+	std::vector<int> ownDigits; // empty when shared
+	std::shared_ptr<SharedDigits> sharedDigits; // nullptr when not shared
 	enum class Sign { positive, negative };
 	Sign sign; // Positive == 0(false), Negative == 1(true)
 
@@ -108,4 +166,11 @@ bool operator!=(const BigInt& lhs, const BigInt& rhs);
 bool operator<(const BigInt& lhs, const BigInt& rhs);
 bool operator>(const BigInt& lhs, const BigInt& rhs);
 bool operator<=(const BigInt& lhs, const BigInt& rhs);
-bool operator>=(const BigInt& lhs, const BigInt& rhs);
\ No newline at end of file
+bool operator>=(const BigInt& lhs, const BigInt& rhs);
+
+namespace std {
+	template<> struct hash<BigInt>
+	{
+		std::size_t operator()(const BigInt& bi) const { return bi.hash(); }
+	};
+}
\ No newline at end of file
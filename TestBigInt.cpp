@@ -93,6 +93,146 @@ std::ostream& performTest(std::ostream& os, TestBigInt& t)
 	return os;
 }
 
+std::ostream& testIncDec(std::ostream& os)
+// Test increment, decrement, negate() and unary minus; if unexpected result happens than write it to os
+{
+	// { number, number after ++, number after -- }; covers carrying and borrowing through many digits, and going through zero
+	const std::vector<std::vector<std::string>> cases{
+		{ "0", "1", "-1" },
+		{ "-1", "0", "-2" },
+		{ "1", "2", "0" },
+		{ "999", "1000", "998" },
+		{ "1000", "1001", "999" },
+		{ "-999", "-998", "-1000" },
+		{ "-1000", "-999", "-1001" },
+		{ "99999999999999999999", "100000000000000000000", "99999999999999999998" },
+		{ "-0", "1", "-1" }, // not normalized input
+		{ "00", "1", "-1" },
+		{ "-00", "1", "-1" },
+		{ "-0100", "-99", "-101" }
+	};
+	for (auto it = cases.cbegin(); it != cases.cend(); ++it) {
+		const std::string& num = (*it)[0];
+		BigInt inc{ num };
+		++inc;
+		checkResult(os, "++" + num, (*it)[1], inc.toString());
+		BigInt dec{ num };
+		--dec;
+		checkResult(os, "--" + num, (*it)[2], dec.toString());
+
+		BigInt postInc{ num };
+		checkResult(os, num + "++ return", BigInt(num).toString(), (postInc++).toString());
+		checkResult(os, num + "++", (*it)[1], postInc.toString());
+		BigInt postDec{ num };
+		checkResult(os, num + "-- return", BigInt(num).toString(), (postDec--).toString());
+		checkResult(os, num + "--", (*it)[2], postDec.toString());
+	}
+
+	BigInt zero;
+	zero.negate();
+	checkResult(os, "negate 0", "0", zero.toString());
+	if (zero != BigInt(0))
+		os << "Test not passed: negate 0 is not equal to 0\n";
+
+	BigInt num{ 12 };
+	num.negate();
+	checkResult(os, "negate 12", "-12", num.toString());
+	num.negate();
+	checkResult(os, "negate -12", "12", num.toString());
+
+	checkResult(os, "unary minus", "-12", (-num).toString());
+	checkResult(os, "unary minus leaves operand", "12", num.toString());
+	checkResult(os, "unary plus", "12", (+num).toString());
+	checkResult(os, "unary minus on rvalue", "-12", (-BigInt(12)).toString());
+	checkResult(os, "unary minus on rvalue zero", "0", (-BigInt(0)).toString());
+
+	BigInt sharedNum{ 12 }; // shared, so that it can be seen whether the digits were taken or copied
+	sharedNum.share();
+	BigInt saved{ sharedNum };
+	BigInt negated = -std::move(sharedNum);
+	checkResult(os, "unary minus on shared rvalue", "-12", negated.toString());
+	if (!negated.sharesDigitsWith(saved))
+		os << "Test not passed: unary minus on rvalue copied the digits instead of taking them\n";
+
+	return os;
+}
+
+std::ostream& testSharedStorage(std::ostream& os)
+// Test share(): copy-on-write of shared digits, and remembered toString(), digitSum() and hash(); if unexpected result happens than write it to os
+{
+	const std::string value = "123456789123456789123456789";
+	const std::string valuePlusOne = "123456789123456789123456790";
+
+	BigInt notShared{ value };
+	BigInt notSharedCopy{ notShared };
+	if (notShared.isShared() || notSharedCopy.sharesDigitsWith(notShared))
+		os << "Test not passed: BigInt shares digits without share()\n";
+
+	BigInt shared{ value };
+	shared.share();
+	// fill in the remembered values, so that it can be checked that they don't leak into changed copies
+	checkResult(os, "shared toString", value, shared.toString());
+	checkResult(os, "shared digitSum", iToString(notShared.digitSum()), iToString(shared.digitSum()));
+	if (shared.hash() != notShared.hash() || std::hash<BigInt>{}(shared) != std::hash<BigInt>{}(notShared))
+		os << "Test not passed: shared and not shared " << value << " have different hash\n";
+
+	BigInt copy{ shared };
+	BigInt negative = -shared;
+	BigInt absolute = negative.abs();
+	if (!copy.sharesDigitsWith(shared) || !negative.sharesDigitsWith(shared) || !absolute.sharesDigitsWith(shared))
+		os << "Test not passed: copies and abs() of shared BigInt copied the digits\n";
+	checkResult(os, "negated shared", "-" + value, negative.toString());
+	checkResult(os, "abs of shared", value, absolute.toString());
+	if (negative.hash() != BigInt("-" + value).hash() || negative.hash() == shared.hash())
+		os << "Test not passed: hash of negated shared " << value << '\n';
+	if (!(absolute == shared) || negative == shared)
+		os << "Test not passed: comparing BigInts with shared digits\n";
+
+	++copy; // has to copy the digits, and not change the other numbers
+	if (copy.sharesDigitsWith(shared) || copy.isShared())
+		os << "Test not passed: changed copy still shares digits\n";
+	checkResult(os, "changed shared copy", valuePlusOne, copy.toString());
+	checkResult(os, "original of changed shared copy", value, shared.toString());
+	checkResult(os, "abs of original of changed shared copy", value, absolute.toString());
+	checkResult(os, "changed shared copy digitSum", iToString(BigInt(valuePlusOne).digitSum()), iToString(copy.digitSum()));
+	if (copy.hash() != BigInt(valuePlusOne).hash())
+		os << "Test not passed: hash of changed shared copy\n";
+
+	copy.share(); // shared again; remembered values have to be computed for the new digits
+	checkResult(os, "reshared copy", valuePlusOne, copy.toString());
+	checkResult(os, "reshared copy digitSum", iToString(BigInt(valuePlusOne).digitSum()), iToString(copy.digitSum()));
+	if (copy.hash() != BigInt(valuePlusOne).hash())
+		os << "Test not passed: hash of reshared copy\n";
+
+	BigInt alone{ 999 }; // shared, but with no copies
+	alone.share();
+	alone.toString();
+	alone.digitSum();
+	alone.hash();
+	++alone;
+	checkResult(os, "changed shared 999", "1000", alone.toString());
+	checkResult(os, "changed shared 999 digitSum", "1", iToString(alone.digitSum()));
+	if (alone.hash() != BigInt(1000).hash())
+		os << "Test not passed: hash of changed shared 999\n";
+
+	for (int i = -20; i <= 20; ++i) { // hash has to agree with operator== whether shared or not
+		BigInt a{ i };
+		BigInt b{ iToString(i) };
+		b.share();
+		if (std::hash<BigInt>{}(a) != std::hash<BigInt>{}(b))
+			os << "Test not passed: shared and not shared " << i << " have different hash\n";
+	}
+
+	return os;
+}
+
+std::ostream& checkResult(std::ostream& os, const std::string& label, const std::string& expected, const std::string& got)
+{
+	if (expected != got)
+		os << "Test not passed: " << label << "\n\tExpected: " << expected << ", got " << got << "\n";
+	return os;
+}
+
 int stringToI(const std::string& s)
 // simple string-to-integer conversion
 {
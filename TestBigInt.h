@@ -2,6 +2,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <functional>
 #include <stdexcept>
 #include <sstream>
 #include "BigInt.h"
@@ -47,6 +48,15 @@ std::istream& operator>>(std::istream& is, TestBigInt& t);
 // Test the BigInt with the given test case; if unexpected result happens than write it to os
 std::ostream& performTest(std::ostream& os, TestBigInt& t);
 
+// Test increment, decrement, negate() and unary minus; if unexpected result happens than write it to os
+std::ostream& testIncDec(std::ostream& os);
+
+// Test share(): copy-on-write of shared digits, and remembered toString(), digitSum() and hash(); if unexpected result happens than write it to os
+std::ostream& testSharedStorage(std::ostream& os);
+
+// Write to os if expected and got differ; label says which test it was
+std::ostream& checkResult(std::ostream& os, const std::string& label, const std::string& expected, const std::string& got);
+
 // Needed for auto-checking
 int stringToI(const std::string& s);
 std::string iToString(int a);
\ No newline at end of file
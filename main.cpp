@@ -21,6 +21,10 @@ int main()
 		std::cout << "Testing: " << it->label << ' ' << it->num1 << ' ' << it->num2 << ' ' << it->autoChecked << '\n'; 
 		performTest(ofs, (*it));
 	}
+	std::cout << "Testing: increment, decrement and unary minus\n";
+	testIncDec(ofs);
+	std::cout << "Testing: shared storage\n";
+	testSharedStorage(ofs);
 	std::cout << "Tests Complete! \n";
 
 	return 0;